@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "AstPrinter.hpp"
+#include "ConstantFolder.hpp"
+#include "Expr.hpp"
+#include "Interpreter.hpp"
+#include "SourceGenerator.hpp"
+
+namespace {
+
+using namespace lox::ast;
+
+struct NodeCounter : public Expr::Visitor {
+  std::size_t count = 0;
+
+  std::size_t countNodes(Expr *expr) {
+    count = 0;
+    expr->accept(*this);
+    return count;
+  }
+
+  void visitBinaryExpr(Binary &expr) override {
+    count++;
+    expr.left->accept(*this);
+    expr.right->accept(*this);
+  }
+  void visitGroupingExpr(Grouping &expr) override {
+    count++;
+    expr.expression->accept(*this);
+  }
+  void visitLiteralExpr(Literal &) override { count++; }
+  void visitUnaryExpr(Unary &expr) override {
+    count++;
+    expr.right->accept(*this);
+  }
+};
+
+// Runs `fn(expr)` on a tree of depth state.range(0) and reports nodes/s
+template <typename F> void walk(benchmark::State &state, F &&fn) {
+  const auto expr =
+      lox::bench::numericExpr(static_cast<std::size_t>(state.range(0)));
+  const auto nodes = NodeCounter{}.countNodes(expr.get());
+
+  for (auto _ : state) {
+    fn(expr.get());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(nodes));
+  state.counters["nodes"] = static_cast<double>(nodes);
+}
+
+void BM_AstPrinter(benchmark::State &state) {
+  AstPrinter printer;
+  walk(state, [&](Expr *expr) {
+    benchmark::DoNotOptimize(printer.print(expr));
+  });
+}
+
+void BM_AstPrinterRPN(benchmark::State &state) {
+  AstPrinterRPN printer;
+  walk(state, [&](Expr *expr) {
+    benchmark::DoNotOptimize(printer.print(expr));
+  });
+}
+
+void BM_Interpreter(benchmark::State &state) {
+  Interpreter interpreter;
+  walk(state, [&](Expr *expr) {
+    benchmark::DoNotOptimize(interpreter.evaluate(expr));
+  });
+}
+
+// Folding rewrites the tree, so each fold needs a fresh copy. Trees are
+// rebuilt in batches of about kBatchNodes nodes per pause, so the cost of
+// PauseTiming/ResumeTiming is amortized over many folds at small depths.
+void BM_ConstantFolder(benchmark::State &state) {
+  constexpr std::size_t kBatchNodes = 1 << 14;
+  const auto depth = static_cast<std::size_t>(state.range(0));
+  const auto nodes =
+      NodeCounter{}.countNodes(lox::bench::numericExpr(depth).get());
+  const auto batch = std::max<std::size_t>(1, kBatchNodes / nodes);
+
+  std::vector<std::unique_ptr<Expr>> trees(batch);
+  ConstantFolder folder;
+  int eliminated = 0;
+
+  while (state.KeepRunningBatch(
+      static_cast<benchmark::IterationCount>(batch))) {
+    state.PauseTiming();
+    for (auto &tree : trees)
+      tree = lox::bench::numericExpr(depth);
+    state.ResumeTiming();
+
+    for (auto &tree : trees) {
+      eliminated = folder.fold(tree);
+      benchmark::DoNotOptimize(tree.get());
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(nodes));
+  state.counters["nodes"] = static_cast<double>(nodes);
+  state.counters["eliminated"] = eliminated;
+}
+
+} // namespace
+
+BENCHMARK(BM_AstPrinter)->DenseRange(4, 16, 4);
+BENCHMARK(BM_AstPrinterRPN)->DenseRange(4, 16, 4);
+BENCHMARK(BM_Interpreter)->DenseRange(4, 16, 4);
+BENCHMARK(BM_ConstantFolder)->DenseRange(4, 16, 4);
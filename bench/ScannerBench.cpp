@@ -0,0 +1,54 @@
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "ErrorHandler.hpp"
+#include "Scanner.hpp"
+#include "SourceGenerator.hpp"
+
+namespace {
+
+using Generator = std::string (*)(std::size_t, std::uint32_t);
+
+void scan(benchmark::State &state, Generator generate) {
+  const auto source =
+      generate(static_cast<std::size_t>(state.range(0)), lox::bench::kSeed);
+  lox::ErrorHandler errorHandler;
+  std::size_t tokens = 0;
+
+  for (auto _ : state) {
+    lox::Scanner scanner(source, errorHandler);
+    const auto &result = scanner.scanTokens();
+    benchmark::DoNotOptimize(result.data());
+    tokens += result.size();
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(source.size()));
+  state.SetItemsProcessed(static_cast<int64_t>(tokens));
+}
+
+void BM_ScanIdentifiers(benchmark::State &state) {
+  scan(state, lox::bench::identifierSource);
+}
+void BM_ScanNumbers(benchmark::State &state) {
+  scan(state, lox::bench::numberSource);
+}
+void BM_ScanStrings(benchmark::State &state) {
+  scan(state, lox::bench::stringSource);
+}
+void BM_ScanComments(benchmark::State &state) {
+  scan(state, lox::bench::commentSource);
+}
+// Every identifier is a reserved word, so this measures KEYWORDS lookup
+void BM_ScanKeywords(benchmark::State &state) {
+  scan(state, lox::bench::keywordSource);
+}
+
+} // namespace
+
+BENCHMARK(BM_ScanIdentifiers)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_ScanNumbers)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_ScanStrings)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_ScanComments)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_ScanKeywords)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
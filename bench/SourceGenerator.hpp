@@ -0,0 +1,158 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "Expr.hpp"
+#include "Object.hpp"
+#include "Token.hpp"
+#include "TokenType.hpp"
+
+// Deterministic synthetic inputs for the benchmarks. The same (size, seed)
+// always produces the same output so results are comparable across runs.
+namespace lox::bench {
+
+inline constexpr std::uint32_t kSeed = 42;
+
+// Build a source of roughly `bytes` characters by repeatedly appending
+// `piece(rng, out)` followed by a separator.
+template <typename F>
+std::string generate(std::size_t bytes, F &&piece, std::uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::string out;
+  out.reserve(bytes + 64);
+  while (out.size() < bytes) {
+    piece(rng, out);
+    out += (rng() % 8 == 0) ? '\n' : ' ';
+  }
+  return out;
+}
+
+// Identifiers that are never keywords
+inline std::string identifierSource(std::size_t bytes,
+                                    std::uint32_t seed = kSeed) {
+  // Keywords are lower case, so an upper case first letter never matches
+  constexpr std::string_view head = "ABCDEFGHIJKLMNOPQRSTUVWXYZ_";
+  constexpr std::string_view tail = "abcdefghijklmnopqrstuvwxyz_0123456789";
+  return generate(
+      bytes,
+      [&](std::mt19937 &rng, std::string &out) {
+        out += head[rng() % head.size()];
+        const auto len = rng() % 12;
+        for (std::size_t i = 0; i < len; i++)
+          out += tail[rng() % tail.size()];
+      },
+      seed);
+}
+
+// Integer and fractional number literals
+inline std::string numberSource(std::size_t bytes,
+                                std::uint32_t seed = kSeed) {
+  return generate(
+      bytes,
+      [](std::mt19937 &rng, std::string &out) {
+        out += std::to_string(rng() % 100000);
+        if (rng() % 2 == 0) {
+          out += '.';
+          out += std::to_string(rng() % 1000);
+        }
+      },
+      seed);
+}
+
+// String literals, some spanning lines
+inline std::string stringSource(std::size_t bytes,
+                                std::uint32_t seed = kSeed) {
+  constexpr std::string_view chars = "abcdefghijklmnopqrstuvwxyz0123456789 \n";
+  return generate(
+      bytes,
+      [&](std::mt19937 &rng, std::string &out) {
+        out += '"';
+        const auto len = rng() % 32;
+        for (std::size_t i = 0; i < len; i++)
+          out += chars[rng() % chars.size()];
+        out += '"';
+      },
+      seed);
+}
+
+// Line comments, which the scanner skips without producing tokens
+inline std::string commentSource(std::size_t bytes,
+                                 std::uint32_t seed = kSeed) {
+  constexpr std::string_view chars = "abcdefghijklmnopqrstuvwxyz0123456789 ";
+  return generate(
+      bytes,
+      [&](std::mt19937 &rng, std::string &out) {
+        out += "//";
+        const auto len = rng() % 80;
+        for (std::size_t i = 0; i < len; i++)
+          out += chars[rng() % chars.size()];
+        out += '\n';
+      },
+      seed);
+}
+
+// Only reserved words, so every identifier hits KEYWORDS
+inline std::string keywordSource(std::size_t bytes,
+                                 std::uint32_t seed = kSeed) {
+  constexpr std::array<std::string_view, 16> keywords = {
+      "and", "class", "else",   "false", "for",   "fun",  "if",  "nil",
+      "or",  "print", "return", "super", "this",  "true", "var", "while"};
+  return generate(
+      bytes,
+      [&](std::mt19937 &rng, std::string &out) {
+        out += keywords[rng() % keywords.size()];
+      },
+      seed);
+}
+
+// Random numeric expression tree of at most `depth` levels. Only uses
+// operators that cannot raise a RuntimeError on numbers.
+inline std::unique_ptr<ast::Expr> numericExpr(std::size_t depth,
+                                              std::mt19937 &rng) {
+  using namespace ast;
+  const auto literal = [&]() {
+    return std::make_unique<Literal>(
+        std::make_unique<Object>(static_cast<double>(rng() % 1000) / 10.0));
+  };
+  if (depth == 0)
+    return literal();
+
+  constexpr std::array<std::pair<TokenType, std::string_view>, 4> ops = {{
+      {TokenType::PLUS, "+"},
+      {TokenType::MINUS, "-"},
+      {TokenType::STAR, "*"},
+      {TokenType::SLASH, "/"},
+  }};
+
+  switch (rng() % 5) {
+  case 0:
+    return std::make_unique<Unary>(
+        std::make_unique<Token>(TokenType::MINUS, "-", Object{}, 1),
+        numericExpr(depth - 1, rng));
+  case 1:
+    return std::make_unique<Grouping>(numericExpr(depth - 1, rng));
+  default: {
+    const auto &[type, lexeme] = ops[rng() % ops.size()];
+    auto left = numericExpr(depth - 1, rng);
+    auto right = numericExpr(depth - 1, rng);
+    return std::make_unique<Binary>(
+        std::move(left),
+        std::make_unique<Token>(type, std::string(lexeme), Object{}, 1),
+        std::move(right));
+  }
+  }
+}
+
+inline std::unique_ptr<ast::Expr> numericExpr(std::size_t depth,
+                                              std::uint32_t seed = kSeed) {
+  std::mt19937 rng(seed);
+  return numericExpr(depth, rng);
+}
+
+} // namespace lox::bench
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cmath>
+#include <memory>
+
+#include "Expr.hpp"
+#include "Interpreter.hpp"
+#include "Object.hpp"
+#include "TokenType.hpp"
+
+namespace lox::ast {
+
+// Rewrites an expression tree in place: folds constant subtrees into
+// Literals, drops Grouping wrappers and applies algebraic identities that
+// are exact under IEEE doubles. Subtrees that would raise a RuntimeError are
+// left alone so the error still surfaces when the program runs.
+struct ConstantFolder : public Expr::Visitor {
+  // Fold `expr` and return the number of AST nodes eliminated
+  int fold(std::unique_ptr<Expr> &expr) {
+    eliminated = 0;
+    rewrite(expr);
+    return eliminated;
+  }
+
+  inline void visitBinaryExpr(Binary &expr) override {
+    rewrite(expr.left);
+    rewrite(expr.right);
+
+    if (isLiteral(expr.left.get()) && isLiteral(expr.right.get())) {
+      if (foldToLiteral(expr))
+        eliminated += 2;
+      return;
+    }
+
+    switch (expr.op->type) {
+    case TokenType::STAR:
+      // x * 1 and 1 * x
+      if (isNumber(expr.left.get()) && isLiteralNumber(expr.right.get(), 1.0)) {
+        replacement = std::move(expr.left);
+        eliminated += 2;
+      } else if (isLiteralNumber(expr.left.get(), 1.0) &&
+                 isNumber(expr.right.get())) {
+        replacement = std::move(expr.right);
+        eliminated += 2;
+      }
+      break;
+    case TokenType::SLASH:
+      // x / 1
+      if (isNumber(expr.left.get()) && isLiteralNumber(expr.right.get(), 1.0)) {
+        replacement = std::move(expr.left);
+        eliminated += 2;
+      }
+      break;
+    case TokenType::MINUS:
+      // x - 0, but not x - (-0): -0 - -0 is +0
+      if (isNumber(expr.left.get()) && isLiteralNumber(expr.right.get(), 0.0)) {
+        replacement = std::move(expr.left);
+        eliminated += 2;
+      }
+      break;
+    default:
+      break;
+    }
+  }
+
+  inline void visitGroupingExpr(Grouping &expr) override {
+    rewrite(expr.expression);
+    replacement = std::move(expr.expression);
+    eliminated += 1;
+  }
+
+  inline void visitLiteralExpr(Literal &) override {}
+
+  inline void visitUnaryExpr(Unary &expr) override {
+    rewrite(expr.right);
+
+    if (isLiteral(expr.right.get())) {
+      if (foldToLiteral(expr))
+        eliminated += 1;
+      return;
+    }
+
+    // --x is x for numbers, !!b is b for booleans
+    auto *inner = dynamic_cast<Unary *>(expr.right.get());
+    if (inner == nullptr || inner->op->type != expr.op->type)
+      return;
+
+    const bool sameType = (expr.op->type == TokenType::MINUS)
+                              ? isNumber(inner->right.get())
+                              : isBool(inner->right.get());
+    if (sameType) {
+      replacement = std::move(inner->right);
+      eliminated += 2;
+    }
+  }
+
+private:
+  int eliminated = 0;
+  // Set by a visit method when the visited node should be replaced
+  std::unique_ptr<Expr> replacement;
+
+  void rewrite(std::unique_ptr<Expr> &expr) {
+    expr->accept(*this);
+    if (replacement) {
+      expr = std::move(replacement);
+    }
+  }
+
+  // Evaluate a node whose operands are all literals. Returns false if
+  // evaluation raises a runtime error.
+  bool foldToLiteral(Expr &expr) {
+    try {
+      Interpreter interpreter;
+      replacement = std::make_unique<Literal>(
+          std::make_unique<Object>(interpreter.evaluate(&expr)));
+      return true;
+    } catch (const RuntimeError &) {
+      return false;
+    }
+  }
+
+  static bool isLiteral(Expr *expr) {
+    return dynamic_cast<Literal *>(expr) != nullptr;
+  }
+
+  // Matches the exact value, so +0 does not match a literal -0
+  static bool isLiteralNumber(Expr *expr, double value) {
+    const auto *literal = dynamic_cast<Literal *>(expr);
+    return literal != nullptr && literal->value->is<double>() &&
+           literal->value->get<double>() == value &&
+           std::signbit(literal->value->get<double>()) == std::signbit(value);
+  }
+
+  // True if `expr` either evaluates to a number or raises a runtime error
+  static bool isNumber(Expr *expr) {
+    if (const auto *literal = dynamic_cast<Literal *>(expr))
+      return literal->value->is<double>();
+    if (const auto *unary = dynamic_cast<Unary *>(expr))
+      return unary->op->type == TokenType::MINUS;
+    if (const auto *binary = dynamic_cast<Binary *>(expr)) {
+      const auto type = binary->op->type;
+      return type == TokenType::MINUS || type == TokenType::STAR ||
+             type == TokenType::SLASH;
+    }
+    return false;
+  }
+
+  // True if `expr` either evaluates to a boolean or raises a runtime error
+  static bool isBool(Expr *expr) {
+    if (const auto *literal = dynamic_cast<Literal *>(expr))
+      return literal->value->is<bool>();
+    if (const auto *unary = dynamic_cast<Unary *>(expr))
+      return unary->op->type == TokenType::BANG;
+    if (const auto *binary = dynamic_cast<Binary *>(expr)) {
+      switch (binary->op->type) {
+      case TokenType::GREATER:
+      case TokenType::GREATER_EQUAL:
+      case TokenType::LESS:
+      case TokenType::LESS_EQUAL:
+      case TokenType::BANG_EQUAL:
+      case TokenType::EQUAL_EQUAL:
+        return true;
+      default:
+        return false;
+      }
+    }
+    return false;
+  }
+};
+
+} // namespace lox::ast
@@ -11,6 +11,7 @@ public:
   void report(int line, std::string_view where, std::string_view message) {
     std::cerr << "[line " << line << "] Error" << where << ": " << message
               << "\n";
+    m_hadError = true;
   }
 
   void error(int line, const std::string &message) {
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+#include "Expr.hpp"
+#include "NodeProfiler.hpp"
+#include "Object.hpp"
+#include "Token.hpp"
+#include "TokenType.hpp"
+
+namespace lox {
+
+struct RuntimeError : public std::runtime_error {
+  RuntimeError(const Token &token, const std::string &message)
+      : std::runtime_error(message), token(token) {}
+
+  // Copied so the error stays valid after the AST it came from is gone
+  Token token;
+};
+
+} // namespace lox
+
+namespace lox::ast {
+
+// Tree-walking evaluator for expressions
+struct Interpreter : public Expr::Visitor {
+  using R = Object;
+  R acceptRet;
+
+  NodeProfiler<kNodeStats> profiler;
+
+  R evaluate(Expr *expr) {
+    expr->accept(*this);
+    return std::move(acceptRet);
+  }
+
+  // nil and false are falsey, everything else is truthy
+  static bool isTruthy(const Object &object) {
+    if (object.empty())
+      return false;
+    if (object.is<bool>())
+      return object.get<bool>();
+    return true;
+  }
+
+  static void checkNumberOperand(const Token &op, const Object &operand) {
+    if (operand.is<double>())
+      return;
+    throw RuntimeError(op, "Operand must be a number.");
+  }
+
+  static void checkNumberOperands(const Token &op, const Object &left,
+                                  const Object &right) {
+    if (left.is<double>() && right.is<double>())
+      return;
+    throw RuntimeError(op, "Operands must be numbers.");
+  }
+
+  inline void visitBinaryExpr(Binary &expr) override {
+    [[maybe_unused]] const auto scope =
+        profiler.enter(NodeKind::Binary, expr.op->type);
+    const auto left = evaluate(expr.left.get());
+    const auto right = evaluate(expr.right.get());
+    const auto &op = *expr.op;
+
+    switch (op.type) {
+    case TokenType::MINUS:
+      checkNumberOperands(op, left, right);
+      acceptRet = Object(left.get<double>() - right.get<double>());
+      return;
+    case TokenType::SLASH:
+      checkNumberOperands(op, left, right);
+      acceptRet = Object(left.get<double>() / right.get<double>());
+      return;
+    case TokenType::STAR:
+      checkNumberOperands(op, left, right);
+      acceptRet = Object(left.get<double>() * right.get<double>());
+      return;
+    case TokenType::PLUS:
+      if (left.is<double>() && right.is<double>()) {
+        acceptRet = Object(left.get<double>() + right.get<double>());
+        return;
+      }
+      if (left.is<std::string>() && right.is<std::string>()) {
+        acceptRet = Object(left.get<std::string>() + right.get<std::string>());
+        return;
+      }
+      throw RuntimeError(op, "Operands must be two numbers or two strings.");
+
+    case TokenType::GREATER:
+      checkNumberOperands(op, left, right);
+      acceptRet = Object(left.get<double>() > right.get<double>());
+      return;
+    case TokenType::GREATER_EQUAL:
+      checkNumberOperands(op, left, right);
+      acceptRet = Object(left.get<double>() >= right.get<double>());
+      return;
+    case TokenType::LESS:
+      checkNumberOperands(op, left, right);
+      acceptRet = Object(left.get<double>() < right.get<double>());
+      return;
+    case TokenType::LESS_EQUAL:
+      checkNumberOperands(op, left, right);
+      acceptRet = Object(left.get<double>() <= right.get<double>());
+      return;
+
+    case TokenType::BANG_EQUAL:
+      acceptRet = Object(!(left == right));
+      return;
+    case TokenType::EQUAL_EQUAL:
+      acceptRet = Object(left == right);
+      return;
+
+    default:
+      // Unreachable
+      acceptRet = Object{};
+    }
+  }
+
+  inline void visitGroupingExpr(Grouping &expr) override {
+    [[maybe_unused]] const auto scope = profiler.enter(NodeKind::Grouping);
+    acceptRet = evaluate(expr.expression.get());
+  }
+
+  inline void visitLiteralExpr(Literal &expr) override {
+    [[maybe_unused]] const auto scope = profiler.enter(NodeKind::Literal);
+    acceptRet = *expr.value;
+  }
+
+  inline void visitUnaryExpr(Unary &expr) override {
+    [[maybe_unused]] const auto scope =
+        profiler.enter(NodeKind::Unary, expr.op->type);
+    const auto right = evaluate(expr.right.get());
+    const auto &op = *expr.op;
+
+    switch (op.type) {
+    case TokenType::MINUS:
+      checkNumberOperand(op, right);
+      acceptRet = Object(-right.get<double>());
+      return;
+    case TokenType::BANG:
+      acceptRet = Object(!isTruthy(right));
+      return;
+
+    default:
+      // Unreachable
+      acceptRet = Object{};
+    }
+  }
+};
+
+} // namespace lox::ast
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "magic_enum/magic_enum.hpp"
+
+#include "TokenType.hpp"
+
+namespace lox::ast {
+
+// Enabled with the CPPLOX_NODE_STATS CMake option
+#ifdef CPPLOX_NODE_STATS
+inline constexpr bool kNodeStats = true;
+#else
+inline constexpr bool kNodeStats = false;
+#endif
+
+enum class NodeKind { Binary, Grouping, Literal, Unary };
+
+// Execution histogram of evaluated AST nodes, keyed by node kind and, for
+// Binary/Unary, by operator. Records the count and self time (excluding
+// children) of each key.
+template <bool Enabled> class NodeProfiler {
+  using clock = std::chrono::steady_clock;
+
+  struct Entry {
+    std::uint64_t count = 0;
+    clock::duration self{0};
+  };
+
+  static constexpr auto kOps = magic_enum::enum_count<TokenType>();
+
+public:
+  // Times one node visit, from construction until destruction
+  class Scope {
+  public:
+    Scope(NodeProfiler &profiler, Entry &entry)
+        : profiler(profiler), entry(entry), start(clock::now()) {
+      profiler.childTime.emplace_back(0);
+    }
+
+    ~Scope() {
+      const auto elapsed = clock::now() - start;
+      entry.count++;
+      entry.self += elapsed - profiler.childTime.back();
+      profiler.childTime.pop_back();
+      if (!profiler.childTime.empty())
+        profiler.childTime.back() += elapsed;
+    }
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+  private:
+    NodeProfiler &profiler;
+    Entry &entry;
+    clock::time_point start;
+  };
+
+  Scope enter(NodeKind kind, TokenType op = TokenType::LOX_EOF) {
+    const auto idx = magic_enum::enum_integer(kind) * kOps +
+                     *magic_enum::enum_index(op);
+    return Scope(*this, entries[idx]);
+  }
+
+  // Print all recorded keys sorted by self time, highest first
+  void report(std::ostream &os) const {
+    std::vector<std::size_t> used;
+    for (std::size_t i = 0; i < entries.size(); i++) {
+      if (entries[i].count > 0)
+        used.push_back(i);
+    }
+    std::sort(used.begin(), used.end(), [&](std::size_t a, std::size_t b) {
+      return entries[a].self > entries[b].self;
+    });
+
+    os << std::left << std::setw(24) << "node" << std::right << std::setw(12)
+       << "count" << std::setw(14) << "self (ms)" << std::setw(12)
+       << "avg (ns)" << "\n";
+    for (const auto i : used) {
+      const auto &entry = entries[i];
+      const auto ns = std::chrono::duration<double, std::nano>(entry.self);
+      os << std::left << std::setw(24) << name(i) << std::right
+         << std::setw(12) << entry.count << std::fixed << std::setprecision(3)
+         << std::setw(14) << ns.count() / 1e6 << std::setprecision(1)
+         << std::setw(12) << ns.count() / entry.count << "\n";
+    }
+  }
+
+private:
+  std::array<Entry, magic_enum::enum_count<NodeKind>() * kOps> entries{};
+  // Time spent in children of each node currently being visited
+  std::vector<clock::duration> childTime;
+
+  static std::string name(std::size_t idx) {
+    const auto kind = magic_enum::enum_value<NodeKind>(idx / kOps);
+    std::string s{magic_enum::enum_name(kind)};
+    if (kind == NodeKind::Binary || kind == NodeKind::Unary) {
+      s += "(";
+      s += magic_enum::enum_name(magic_enum::enum_value<TokenType>(idx % kOps));
+      s += ")";
+    }
+    return s;
+  }
+};
+
+// Compiled out: every call is an empty inline function
+template <> class NodeProfiler<false> {
+public:
+  struct Scope {};
+
+  Scope enter(NodeKind, TokenType = TokenType::LOX_EOF) { return {}; }
+  void report(std::ostream &) const {}
+};
+
+} // namespace lox::ast
@@ -14,7 +14,7 @@ public:
   explicit Object() {}
   explicit Object(const double val) : object(val) {}
   explicit Object(const bool val) : object(val) {}
-  explicit Object(const std::string &val) : object(val) {}
+  explicit Object(std::string val) : object(std::move(val)) {}
 
   auto toString() const -> std::string {
     if (std::holds_alternative<double>(object))
@@ -31,6 +31,16 @@ public:
 
   bool empty() const { return object.index() == 0; }
 
+  template <typename T> bool is() const {
+    return std::holds_alternative<T>(object);
+  }
+
+  template <typename T> const T &get() const { return std::get<T>(object); }
+
+  // Lox equality: values of different types are never equal, nil equals nil
+  // and numbers compare with IEEE semantics (NaN != NaN).
+  bool operator==(const Object &other) const { return object == other.object; }
+
 private:
   std::variant<std::monostate, double, bool, std::string> object;
 };
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+
+namespace lox {
+
+// Timings and counters for each phase of Runtime::run, accumulated across
+// runs (e.g. every line entered at the prompt).
+struct RunStats {
+  using clock = std::chrono::steady_clock;
+  using duration = std::chrono::nanoseconds;
+
+  duration scan{0};
+  // Writing the token stream to stdout; nothing is executed yet
+  duration printTokens{0};
+
+  std::size_t runs = 0;
+  std::size_t sourceBytes = 0;
+  std::size_t tokens = 0;
+
+  // Human readable summary
+  void print(std::ostream &os) const {
+    const auto ms = [](duration d) {
+      return std::chrono::duration<double, std::milli>(d).count();
+    };
+    os << std::fixed << std::setprecision(3);
+    os << "runs:     " << runs << "\n";
+    os << "scan:     " << ms(scan) << " ms (" << sourceBytes << " bytes, "
+       << tokens << " tokens)\n";
+    os << "print:    " << ms(printTokens) << " ms\n";
+    os << "total:    " << ms(scan + printTokens) << " ms\n";
+  }
+
+  // Single line JSON object for machine consumption, durations in ns
+  void printJson(std::ostream &os) const {
+    os << "{\"runs\":" << runs << ",\"source_bytes\":" << sourceBytes
+       << ",\"tokens\":" << tokens << ",\"scan_ns\":" << scan.count()
+       << ",\"print_ns\":" << printTokens.count()
+       << ",\"total_ns\":" << (scan + printTokens).count() << "}\n";
+  }
+};
+
+// Adds the time between construction and destruction to `total`
+class ScopedTimer {
+public:
+  explicit ScopedTimer(RunStats::duration &total)
+      : total(total), start(RunStats::clock::now()) {}
+  ~ScopedTimer() { total += RunStats::clock::now() - start; }
+
+  ScopedTimer(const ScopedTimer &) = delete;
+  ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+private:
+  RunStats::duration &total;
+  RunStats::clock::time_point start;
+};
+
+} // namespace lox
@@ -1,5 +1,6 @@
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -10,15 +11,26 @@
 
 namespace lox {
 
-const static std::unordered_map<std::string, TokenType> KEYWORDS = {
-    {"and", TokenType::AND},       {"class", TokenType::CLASS},
-    {"else", TokenType::ELSE},     {"false", TokenType::FALSE},
-    {"for", TokenType::FOR},       {"fun", TokenType::FUN},
-    {"if", TokenType::IF},         {"nil", TokenType::NIL},
-    {"or", TokenType::OR},         {"print", TokenType::PRINT},
-    {"return", TokenType::RETURN}, {"super", TokenType::SUPER},
-    {"this", TokenType::THIS},     {"true", TokenType::TRUE},
-    {"var", TokenType::VAR},       {"while", TokenType::WHILE},
+// Transparent hash so KEYWORDS can be probed with a string_view into the
+// source without allocating a std::string per identifier.
+struct KeywordHash {
+  using is_transparent = void;
+  auto operator()(std::string_view s) const -> size_t {
+    return std::hash<std::string_view>{}(s);
+  }
+};
+
+const static std::unordered_map<std::string, TokenType, KeywordHash,
+                                std::equal_to<>>
+    KEYWORDS = {
+        {"and", TokenType::AND},       {"class", TokenType::CLASS},
+        {"else", TokenType::ELSE},     {"false", TokenType::FALSE},
+        {"for", TokenType::FOR},       {"fun", TokenType::FUN},
+        {"if", TokenType::IF},         {"nil", TokenType::NIL},
+        {"or", TokenType::OR},         {"print", TokenType::PRINT},
+        {"return", TokenType::RETURN}, {"super", TokenType::SUPER},
+        {"this", TokenType::THIS},     {"true", TokenType::TRUE},
+        {"var", TokenType::VAR},       {"while", TokenType::WHILE},
 };
 
 auto Scanner::isAtEnd() -> bool { return current >= source.size(); }
@@ -27,10 +39,9 @@ auto Scanner::advance() -> char { return source[current++]; }
 
 void Scanner::addToken(const TokenType type) { addToken(type, Object{}); }
 
-void Scanner::addToken(const TokenType type, const Object &literal) {
-  const auto text = source.substr(start, current - start);
-  // tokens.push_back(Token(type, text, std::move(literal), line));
-  tokens.emplace_back(type, text, std::move(literal), line);
+void Scanner::addToken(const TokenType type, Object literal) {
+  auto text = source.substr(start, current - start);
+  tokens.emplace_back(type, std::move(text), std::move(literal), line);
 }
 
 void Scanner::scanToken() {
@@ -48,6 +59,12 @@ void Scanner::scanToken() {
   case '}':
     addToken(TokenType::RIGHT_BRACE);
     break;
+  case '[':
+    addToken(TokenType::LEFT_BRACKET);
+    break;
+  case ']':
+    addToken(TokenType::RIGHT_BRACKET);
+    break;
   case ',':
     addToken(TokenType::COMMA);
     break;
@@ -105,12 +122,6 @@ void Scanner::scanToken() {
     string();
     break;
 
-  case 'o':
-    if (match('r')) {
-      addToken(TokenType::OR);
-    }
-    break;
-
   default:
 
     if (isDigit(c)) {
@@ -170,8 +181,8 @@ void Scanner::string() {
   // The closing "
   advance();
   // Trim the surrounding quotes
-  const std::string value = source.substr(start + 1, current - 2 - start);
-  addToken(TokenType::STRING, Object(value));
+  addToken(TokenType::STRING,
+           Object(source.substr(start + 1, current - 2 - start)));
 }
 
 void Scanner::number() {
@@ -205,7 +216,7 @@ void Scanner::identifier() {
   while (isAlphaNumeric(peek()))
     advance();
 
-  const auto text = source.substr(start, current - start);
+  const auto text = std::string_view(source).substr(start, current - start);
   TokenType type = [&]() {
     if (auto it = KEYWORDS.find(text); it != KEYWORDS.end()) {
       return it->second;
@@ -21,7 +21,7 @@ private:
   auto isAtEnd() -> bool;
   auto advance() -> char;
   void addToken(const TokenType type);
-  void addToken(const TokenType type, const Object &literal);
+  void addToken(const TokenType type, Object literal);
   void scanToken();
   auto match(char expected) -> bool;
   // Look ahead
@@ -19,9 +19,9 @@ struct Token {
   Object literal;
   int line;
 
-  Token(const TokenType type, const std::string &lexeme, const Object &literal,
-        int line)
-      : type(type), lexeme(lexeme), literal(literal), line(line) {}
+  Token(const TokenType type, std::string lexeme, Object literal, int line)
+      : type(type), lexeme(std::move(lexeme)), literal(std::move(literal)),
+        line(line) {}
 
   inline std::string toString() const {
     using namespace std::string_literals;
@@ -1,6 +1,9 @@
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <iterator>
+#include <optional>
+#include <sstream>
 #include <string>
 #include <string_view>
 #include <sys/wait.h>
@@ -8,11 +11,14 @@
 
 #include "ErrorHandler.hpp"
 #include "Object.hpp"
+#include "RunStats.hpp"
 #include "Scanner.hpp"
 #include "Token.hpp"
 
 #include "AstPrinter.hpp"
+#include "ConstantFolder.hpp"
 #include "Expr.hpp"
+#include "Interpreter.hpp"
 #include "TokenType.hpp"
 #include <memory>
 
@@ -24,28 +30,31 @@ public:
   Runtime() {}
 
   void run(const std::string &src) {
+    stats.runs++;
+    stats.sourceBytes += src.size();
+
     Scanner scanner(src, errorHandler);
-    const auto &tokens = scanner.scanTokens();
+    const auto &tokens = [&]() -> const std::vector<Token> & {
+      ScopedTimer timer(stats.scan);
+      return scanner.scanTokens();
+    }();
+    stats.tokens += tokens.size();
+
+    ScopedTimer timer(stats.printTokens);
     for (const auto &token : tokens) {
       std::cout << token << "\n";
     }
   }
 
   int runFile(const std::string &path) {
-    std::ifstream ifile(path);
-
-    //   ifile.seekg(0, std::ios::end);
-    //   size_t length = ifile.tellg();
-    //   ifile.seekg(0, std::ios::beg);
-    //   std::vector<char> buffer;
-    //   buffer.reserve(length);
-    //   ifile.read(buffer.data(), length);
-
-    std::string line;
-    while (std::getline(ifile, line)) {
-      std::cout << line << "\n";
+    auto src = readFile(path);
+    if (!src) {
+      std::cerr << "Could not read file \"" << path << "\".\n";
+      return 74;
     }
 
+    run(*src);
+
     if (errorHandler.hadError()) {
       return 65;
     }
@@ -66,26 +75,51 @@ public:
     return 0;
   }
 
+  const RunStats &getStats() const { return stats; }
+
 private:
+  // Read the whole script. Regular files are sized up front and read with a
+  // single read; pipes and other non-seekable streams are read through the
+  // stream buffer instead.
+  static std::optional<std::string> readFile(const std::string &path) {
+    std::error_code ec;
+    if (std::filesystem::is_directory(path, ec))
+      return std::nullopt;
+
+    std::ifstream ifile(path, std::ios::binary);
+    if (!ifile)
+      return std::nullopt;
+
+    ifile.seekg(0, std::ios::end);
+    const auto length = ifile.tellg();
+    if (length < 0) {
+      ifile.clear();
+      std::ostringstream ss;
+      ss << ifile.rdbuf();
+      if (ifile.bad())
+        return std::nullopt;
+      return std::move(ss).str();
+    }
+
+    ifile.seekg(0, std::ios::beg);
+    std::string src(static_cast<size_t>(length), '\0');
+    ifile.read(src.data(), length);
+    if (ifile.gcount() != length)
+      return std::nullopt;
+    return src;
+  }
+
   ErrorHandler errorHandler;
+  RunStats stats;
 };
 
 } // namespace lox
 
-int main(int argc, char **argv) {
-  // lox::Runtime runtime;
-  // if (argc > 2) {
-  //   std::cout << "Usage: cpplox [script]\n";
-  //   return 64;
-  // } else if (argc == 2) {
-  //   return runtime.runFile(argv[1]);
-  // } else {
-  //   return runtime.runPrompt();
-  // }
-
-  // Test Ast
+// Builds the expression from the book's AST chapter by hand, then prints,
+// evaluates and constant-folds it
+static void astDemo() {
   using namespace lox::ast;
-  auto expression = std::make_unique<Binary>(
+  std::unique_ptr<Expr> expression = std::make_unique<Binary>(
       std::make_unique<Unary>(
           std::make_unique<lox::Token>(lox::TokenType::MINUS, "-",
                                        lox::Object{}, 1),
@@ -97,4 +131,60 @@ int main(int argc, char **argv) {
   AstPrinterRPN printer;
 
   std::cout << printer.print(expression.get()) << "\n";
+
+  Interpreter interpreter;
+  std::cout << interpreter.evaluate(expression.get()).toString() << "\n";
+  interpreter.profiler.report(std::cerr);
+
+  ConstantFolder folder;
+  const auto eliminated = folder.fold(expression);
+  std::cout << printer.print(expression.get()) << " (folded " << eliminated
+            << " nodes)\n";
+}
+
+int main(int argc, char **argv) {
+  constexpr auto usage =
+      "Usage: cpplox [--stats[=json]] [--ast-demo] [script]\n";
+
+  enum class StatsFormat { None, Text, Json };
+  auto statsFormat = StatsFormat::None;
+  bool runAstDemo = false;
+  std::vector<std::string> scripts;
+
+  for (int i = 1; i < argc; i++) {
+    const std::string_view arg = argv[i];
+    if (arg == "--stats") {
+      statsFormat = StatsFormat::Text;
+    } else if (arg == "--stats=json") {
+      statsFormat = StatsFormat::Json;
+    } else if (arg == "--ast-demo") {
+      runAstDemo = true;
+    } else if (arg.starts_with("--")) {
+      std::cout << usage;
+      return 64;
+    } else {
+      scripts.emplace_back(arg);
+    }
+  }
+
+  if (scripts.size() > 1 || (runAstDemo && !scripts.empty())) {
+    std::cout << usage;
+    return 64;
+  }
+
+  if (runAstDemo) {
+    astDemo();
+    return 0;
+  }
+
+  lox::Runtime runtime;
+  const int ret = scripts.empty() ? runtime.runPrompt()
+                                  : runtime.runFile(scripts.front());
+
+  if (statsFormat == StatsFormat::Text) {
+    runtime.getStats().print(std::cerr);
+  } else if (statsFormat == StatsFormat::Json) {
+    runtime.getStats().printJson(std::cerr);
+  }
+  return ret;
 }